@@ -94,6 +94,26 @@ void Surface::addDirtyArea(const Common::Rect &r) {
 	} else {
 		_dirtyArea.extend(r);
 	}
+
+	// Additionally, keep track of the separate areas, merging overlapping
+	// ones. An array with more than kMaxDirtyRects entries is incomplete
+	// and only the bounding box is used then.
+	if (r.isEmpty() || _dirtyRects.size() > kMaxDirtyRects) {
+		return;
+	}
+
+	Common::Rect area = r;
+	for (uint i = 0; i < _dirtyRects.size();) {
+		if (_dirtyRects[i].intersects(area)) {
+			area.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+
+	_dirtyRects.push_back(area);
 }
 
 Common::Rect Surface::getDirtyArea() const {
@@ -104,6 +124,14 @@ Common::Rect Surface::getDirtyArea() const {
 	}
 }
 
+Common::Array<Common::Rect> Surface::getDirtyRects() const {
+	if (_allDirty || _dirtyRects.size() > kMaxDirtyRects) {
+		return Common::Array<Common::Rect>();
+	} else {
+		return _dirtyRects;
+	}
+}
+
 //
 // Surface implementations
 //
@@ -167,6 +195,27 @@ void TextureSurface::updateGLTexture() {
 
 	Common::Rect dirtyArea = getDirtyArea();
 
+	// Upload separate dirty areas on their own when that transfers notably
+	// less data than their bounding box. Without GL_UNPACK_ROW_LENGTH whole
+	// texture lines are uploaded, which needs to be accounted for.
+	Common::Array<Common::Rect> dirtyRects = getDirtyRects();
+	if (dirtyRects.size() > 1) {
+		const bool fullLines = !OpenGLContext.unpackSubImageSupported;
+		const uint bboxSize = (fullLines ? getWidth() : dirtyArea.width()) * dirtyArea.height();
+		uint rectsSize = 0;
+
+		for (const Common::Rect &r : dirtyRects) {
+			rectsSize += (fullLines ? getWidth() : r.width()) * r.height();
+		}
+
+		if (rectsSize * 2 < bboxSize) {
+			for (Common::Rect &r : dirtyRects) {
+				updateGLTexture(r);
+			}
+			return;
+		}
+	}
+
 	updateGLTexture(dirtyArea);
 }
 
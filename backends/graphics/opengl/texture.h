@@ -30,6 +30,7 @@
 #include "graphics/surface.h"
 #include "graphics/blit.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/rotationmode.h"
 
@@ -148,13 +149,24 @@ public:
 	 */
 	virtual const Texture &getGLTexture() const = 0;
 protected:
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); _dirtyRects.clear(); }
 
 	void addDirtyArea(const Common::Rect &r);
 	Common::Rect getDirtyArea() const;
+
+	/**
+	 * @return The separate dirty rects, or an empty array in case only the
+	 *         bounding box returned by getDirtyArea is known.
+	 */
+	Common::Array<Common::Rect> getDirtyRects() const;
 private:
+	enum {
+		kMaxDirtyRects = 8
+	};
+
 	bool _allDirty;
 	Common::Rect _dirtyArea;
+	Common::Array<Common::Rect> _dirtyRects;
 };
 
 /**
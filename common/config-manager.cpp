@@ -23,6 +23,7 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -75,6 +76,7 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
+	_lastFlushedData = source._lastFlushedData;
 }
 
 
@@ -83,6 +85,7 @@ bool ConfigManager::loadDefaultConfigFile(const Path &fallbackFilename) {
 	assert(g_system);
 	SeekableReadStream *stream = g_system->createConfigReadStream();
 	_filename.clear(); // clear the filename to indicate that we are using the default config file
+	_lastFlushedData.clear();
 
 	bool loadResult = false;
 	// ... load it, if available ...
@@ -105,6 +108,7 @@ bool ConfigManager::loadDefaultConfigFile(const Path &fallbackFilename) {
 
 bool ConfigManager::loadConfigFile(const Path &filename, const Path &fallbackFilename) {
 	_filename = filename;
+	_lastFlushedData.clear();
 
 	FSNode node(filename);
 	File cfg_file;
@@ -285,59 +289,82 @@ bool ConfigManager::loadFromStream(SeekableReadStream &stream) {
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
-	WriteStream *stream;
-
-	if (_filename.empty()) {
-		// Write to the default config file
-		assert(g_system);
-		stream = g_system->createConfigWriteStream();
-		if (!stream)    // If writing to the config file is not possible, do nothing
-			return;
-	} else {
-		DumpFile *dump = new DumpFile();
-		assert(dump);
-
-		if (!dump->open(_filename)) {
-			warning("Unable to write configuration file: %s", _filename.toString(Common::Path::kNativeSeparator).c_str());
-			delete dump;
-			return;
-		}
-
-		stream = dump;
-	}
+	// Serialize the configuration to memory first. Many callers flush after
+	// every change, even when nothing changed, so only touch the file when
+	// the data differs from what we wrote last time.
+	MemoryWriteStreamDynamic data(DisposeAfterUse::YES);
 
 	// Write the application domain
-	writeDomain(*stream, kApplicationDomain, _appDomain);
+	writeDomain(data, kApplicationDomain, _appDomain);
 
 	// Write the keymapper domain
-	writeDomain(*stream, kKeymapperDomain, _keymapperDomain);
+	writeDomain(data, kKeymapperDomain, _keymapperDomain);
 #ifdef USE_CLOUD
 	// Write the cloud domain
-	writeDomain(*stream, kCloudDomain, _cloudDomain);
+	writeDomain(data, kCloudDomain, _cloudDomain);
 #endif
 
 	// Write the miscellaneous domains next
 	for (const auto &misc : _miscDomains) {
-		writeDomain(*stream, misc._key, misc._value);
+		writeDomain(data, misc._key, misc._value);
 	}
 
 	// First write the domains in _domainSaveOrder, in that order.
 	// Note: It's possible for _domainSaveOrder to list domains which
 	// are not present anymore, so we validate each name.
+	HashMap<String, bool> savedDomains;
 	for (const auto &domain : _domainSaveOrder) {
+		savedDomains[domain] = true;
 		if (_gameDomains.contains(domain)) {
-			writeDomain(*stream, domain, _gameDomains[domain]);
+			writeDomain(data, domain, _gameDomains[domain]);
 		}
 	}
 
 	// Now write the domains which haven't been written yet
 	for (auto &domain : _gameDomains) {
-		if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), domain._key) == _domainSaveOrder.end())
-			writeDomain(*stream, domain._key, domain._value);
+		if (!savedDomains.contains(domain._key))
+			writeDomain(data, domain._key, domain._value);
 	}
 
+	if (!_lastFlushedData.empty() && _lastFlushedData.size() == data.size() &&
+	    memcmp(_lastFlushedData.begin(), data.getData(), data.size()) == 0)
+		return;
+
+	WriteStream *stream;
+
+	if (_filename.empty()) {
+		// Write to the default config file
+		assert(g_system);
+		stream = g_system->createConfigWriteStream();
+		if (!stream)    // If writing to the config file is not possible, do nothing
+			return;
+	} else {
+		DumpFile *dump = new DumpFile();
+		assert(dump);
+
+		if (!dump->open(_filename)) {
+			warning("Unable to write configuration file: %s", _filename.toString(Common::Path::kNativeSeparator).c_str());
+			delete dump;
+			return;
+		}
+
+		stream = dump;
+	}
+
+	stream->write(data.getData(), data.size());
+
+	bool success = stream->flush() && !stream->err();
 	delete stream;
 
+	// Only remember what we wrote if it actually made it to the disk
+	if (success) {
+		_lastFlushedData.resize(data.size());
+		if (data.size())
+			memcpy(_lastFlushedData.begin(), data.getData(), data.size());
+	} else {
+		_lastFlushedData.clear();
+	}
+
 #endif // !__DC__
 }
 
@@ -259,6 +259,9 @@ private:
 	Domain *		_activeDomain;
 
 	Path			_filename;
+
+	/** The data last written by flushToDisk(), used to skip unchanged writes. */
+	Array<byte>		_lastFlushedData;
 };
 
 /** @} */
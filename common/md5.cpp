@@ -248,22 +248,23 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length, Progr
 #ifdef DISABLE_MD5
 	memset(digest, 0, 16);
 #else
+	// Read in large chunks which are a multiple of the 64 byte MD5 block
+	// size, so md5_update() can process them without copying
+	const uint32 kBufSize = 64 * 1024;
+
 	md5_context ctx;
 	int i;
-	unsigned char buf[1000];
 	bool restricted = (length != 0);
-	uint32 readlen;
-
-	if (!restricted || sizeof(buf) <= length)
-		readlen = sizeof(buf);
-	else
-		readlen = length;
+	uint32 bufSize = (restricted && length < kBufSize) ? length : kBufSize;
+	uint32 readlen = bufSize;
+	unsigned char *buf = new unsigned char[bufSize];
 
 	md5_starts(&ctx);
 
 	while ((i = stream.read(buf, readlen)) > 0) {
 
 		if (progressUpdateCallback != nullptr && !progressUpdateCallback(callbackParameter, i)) {
+			delete[] buf;
 			return false;
 		}
 
@@ -274,11 +275,12 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length, Progr
 			if (length == 0)
 				break;
 
-			if (sizeof(buf) > length)
+			if (bufSize > length)
 				readlen = length;
 		}
 	}
 
+	delete[] buf;
 	md5_finish(&ctx, digest);
 #endif
 	return true;
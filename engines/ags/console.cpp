@@ -36,6 +36,7 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_sprite_cache_stats",  WRAP_METHOD(AGSConsole, Cmd_spriteCacheStats));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -245,6 +246,30 @@ bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_spriteCacheStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		_GP(spriteset).ResetStats();
+		return true;
+	}
+
+	const AGS3::AGS::Shared::SpriteCache::Stats &stats = _GP(spriteset).GetStats();
+	const AGS3::uint32_t requests = stats.Hits + stats.Misses;
+	debugPrintf("Cache size: %u KB of %u KB (%u KB locked)\n",
+		(uint)(_GP(spriteset).GetCacheSize() / 1024), (uint)(_GP(spriteset).GetMaxCacheSize() / 1024),
+		(uint)(_GP(spriteset).GetLockedSize() / 1024));
+	debugPrintf("Requests: %u, hits: %u, misses: %u, hit rate: %u%%\n",
+		requests, stats.Hits, stats.Misses, requests ? stats.Hits * 100 / requests : 0);
+	debugPrintf("Loaded: %u, disposed: %u\n", stats.Loads, stats.Disposed);
+	debugPrintf("Load time: %u ms total, %u ms average, %u ms max\n",
+		stats.LoadTimeMs, stats.Loads ? stats.LoadTimeMs / stats.Loads : 0, stats.MaxLoadTimeMs);
+	return true;
+}
+
 LogOutputTarget::LogOutputTarget() {
 }
 
@@ -621,6 +621,13 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 
 	_G(objs) = _G(croom)->obj.size() > 0 ? &_G(croom)->obj[0] : nullptr;
 
+	// Load the sprites of visible objects now, rather than one by one
+	// while the first frames of the new room are being drawn
+	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
+		if (_G(objs)[cc].on)
+			_GP(spriteset).WarmUpSprite(_G(objs)[cc].num);
+	}
+
 	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
 		// export the object's script object
 		if (_GP(thisroom).Objects[cc].ScriptName.IsEmpty())
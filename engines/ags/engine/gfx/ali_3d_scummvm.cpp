@@ -501,31 +501,52 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 	return from;
 }
 
+// Converts a row of ARGB pixels to ABGR or RGBA, writing only the pixels
+// that changed; returns the range of changed pixels in first and last
+template<bool ToRGBA>
+static void convertRowARGB(const uint32 *srcP, uint32 *destP, int w, int &first, int &last) {
+	first = -1;
+	last = -1;
+	for (int x = 0; x < w; ++x) {
+		uint32 pixel;
+		if (ToRGBA) {
+			pixel = ((srcP[x] & 0xffffff) << 8) |
+				((srcP[x] >> 24) & 0xff);
+		} else {
+			pixel = (srcP[x] & 0xff00ff00) |
+				((srcP[x] & 0xff) << 16) |
+				((srcP[x] >> 16) & 0xff);
+		}
+
+		if (destP[x] != pixel) {
+			destP[x] = pixel;
+			if (first == -1)
+				first = x;
+			last = x;
+		}
+	}
+}
+
 void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode) {
 	assert(src.w == _screen->w && src.h == _screen->h && src.pitch == _screen->pitch);
 	const uint32 *srcP = (const uint32 *)src.getPixels();
 	uint32 *destP = (uint32 *)_screen->getPixels();
-	uint32 pixel;
 	int x1 = 9999, y1 = 9999, x2 = -1, y2 = -1;
 
-	for (int y = 0; y < src.h; ++y) {
-		for (int x = 0; x < src.w; ++x, ++srcP, ++destP) {
-			if (!mode) {
-				pixel = (*srcP & 0xff00ff00) |
-					((*srcP & 0xff) << 16) |
-					((*srcP >> 16) & 0xff);
-			} else {
-				pixel = ((*srcP & 0xffffff) << 8) |
-					((*srcP >> 24) & 0xff);
-			}
-
-			if (*destP != pixel) {
-				*destP = pixel;
-				x1 = MIN(x1, x);
-				y1 = MIN(y1, y);
-				x2 = MAX(x2, x);
-				y2 = MAX(y2, y);
-			}
+	// The dirty area is tracked per row rather than per pixel, and the
+	// conversion is picked once per row rather than for each pixel
+	for (int y = 0; y < src.h; ++y, srcP += src.w, destP += src.w) {
+		int first, last;
+		if (mode)
+			convertRowARGB<true>(srcP, destP, src.w, first, last);
+		else
+			convertRowARGB<false>(srcP, destP, src.w, first, last);
+
+		if (last != -1) {
+			x1 = MIN(x1, first);
+			x2 = MAX(x2, last);
+			y1 = MIN(y1, y);
+			y2 = y;
 		}
 	}
 
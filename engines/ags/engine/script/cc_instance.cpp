@@ -562,6 +562,7 @@ int ccInstance::Run(int32_t curpc) {
 	ccInstance *codeInst = runningInst;
 	ScriptOperation codeOp;
 	FunctionCallStack func_callstack;
+	ScriptCommands &commands = *g_commands;
 #if DEBUG_CC_EXEC
 	const bool dump_opcodes = (ccGetOption(SCOPT_DEBUGRUN) != 0) ||
 							  (gDebugLevel > 0 && DebugMan.isDebugChannelEnabled(::AGS::kDebugScript));
@@ -590,7 +591,7 @@ int ccInstance::Run(int32_t curpc) {
 		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
 							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
 
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
+		codeOp.ArgCount = commands[codeOp.Instruction.Code].ArgCount;
 
 		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
 							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
@@ -112,6 +112,13 @@ public:
 	// and x64 builds, so that the script is interpreted correctly.
 	int             Size;
 
+	// Only plugin functions carry a method name; checking for it first
+	// keeps the Set* helpers off the string code in the interpreter loop
+	inline void clearMethodName() {
+		if (!methodName.empty())
+			methodName.clear();
+	}
+
 	inline bool IsValid() const {
 		return Type != kScValUndefined;
 	}
@@ -139,7 +146,7 @@ public:
 
 	inline RuntimeScriptValue &SetUInt8(uint8_t val) {
 		Type = kScValInteger;
-		methodName.clear();
+		clearMethodName();
 		IValue = val;
 		Ptr = nullptr;
 		MgrPtr = nullptr;
@@ -149,7 +156,7 @@ public:
 
 	inline RuntimeScriptValue &SetInt16(int16_t val) {
 		Type = kScValInteger;
-		methodName.clear();
+		clearMethodName();
 		IValue = val;
 		Ptr = nullptr;
 		MgrPtr = nullptr;
@@ -159,7 +166,7 @@ public:
 
 	inline RuntimeScriptValue &SetInt32(int32_t val) {
 		Type = kScValInteger;
-		methodName.clear();
+		clearMethodName();
 		IValue = val;
 		Ptr = nullptr;
 		MgrPtr = nullptr;
@@ -169,7 +176,7 @@ public:
 
 	inline RuntimeScriptValue &SetFloat(float val) {
 		Type = kScValFloat;
-		methodName.clear();
+		clearMethodName();
 		FValue = val;
 		Ptr = nullptr;
 		MgrPtr = nullptr;
@@ -187,7 +194,7 @@ public:
 
 	inline RuntimeScriptValue &SetPluginArgument(int32_t val) {
 		Type = kScValPluginArg;
-		methodName.clear();
+		clearMethodName();
 		IValue = val;
 		Ptr = nullptr;
 		MgrPtr = nullptr;
@@ -197,7 +204,7 @@ public:
 
 	inline RuntimeScriptValue &SetStackPtr(RuntimeScriptValue *stack_entry) {
 		Type = kScValStackPtr;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		RValue = stack_entry;
 		MgrPtr = nullptr;
@@ -207,7 +214,7 @@ public:
 
 	inline RuntimeScriptValue &SetData(void *data, int size) {
 		Type = kScValData;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		Ptr = data;
 		MgrPtr = nullptr;
@@ -217,7 +224,7 @@ public:
 
 	inline RuntimeScriptValue &SetGlobalVar(RuntimeScriptValue *glvar_value) {
 		Type = kScValGlobalVar;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		RValue = glvar_value;
 		MgrPtr = nullptr;
@@ -228,7 +235,7 @@ public:
 	// TODO: size?
 	inline RuntimeScriptValue &SetStringLiteral(const char *str) {
 		Type = kScValStringLiteral;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		Ptr = const_cast<char *>(str);
 		MgrPtr = nullptr;
@@ -238,7 +245,7 @@ public:
 
 	inline RuntimeScriptValue &SetStaticArray(void *object, CCStaticArray *manager) {
 		Type = kScValStaticArray;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		Ptr = object;
 		ArrMgr = manager;
@@ -248,7 +255,7 @@ public:
 
 	inline RuntimeScriptValue &SetScriptObject(void *object, IScriptObject *manager) {
 		Type = kScValScriptObject;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		Ptr = object;
 		ObjMgr = manager;
@@ -258,7 +265,7 @@ public:
 
 	inline RuntimeScriptValue &SetPluginObject(void *object, IScriptObject *manager) {
 		Type = kScValPluginObject;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		Ptr = object;
 		ObjMgr = manager;
@@ -277,7 +284,7 @@ public:
 
 	inline RuntimeScriptValue &SetStaticFunction(ScriptAPIFunction *pfn) {
 		Type = kScValStaticFunction;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		SPfn = pfn;
 		MgrPtr = nullptr;
@@ -297,7 +304,7 @@ public:
 
 	inline RuntimeScriptValue &SetObjectFunction(ScriptAPIObjectFunction *pfn) {
 		Type = kScValObjectFunction;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		ObjPfn = pfn;
 		MgrPtr = nullptr;
@@ -307,7 +314,7 @@ public:
 
 	inline RuntimeScriptValue &SetCodePtr(void *ptr) {
 		Type = kScValCodePtr;
-		methodName.clear();
+		clearMethodName();
 		IValue = 0;
 		Ptr = ptr;
 		MgrPtr = nullptr;
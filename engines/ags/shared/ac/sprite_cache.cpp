@@ -106,6 +106,7 @@ void SpriteCache::Reset() {
 	_mru.clear();
 	_cacheSize = 0;
 	_lockedSize = 0;
+	_stats = Stats();
 }
 
 bool SpriteCache::SetSprite(sprkey_t index, std::unique_ptr<Bitmap> image, int flags) {
@@ -223,15 +224,19 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 		return _placeholder.get();
 
 	// Externally added sprite or locked sprite, don't put it into MRU list
-	if (_spriteData[index].IsExternalSprite() || _spriteData[index].IsLocked())
+	if (_spriteData[index].IsExternalSprite() || _spriteData[index].IsLocked()) {
+		_stats.Hits++;
 		return _spriteData[index].Image.get();
+	}
 	// Either use ready image, or load one from assets
 	if (_spriteData[index].Image) {
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
+		_stats.Hits++;
 		return _spriteData[index].Image.get();
 	} else {
 		// Sprite exists in file but is not in mem, load it and add to MRU list
+		_stats.Misses++;
 		if (LoadSprite(index)) {
 			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
 			return _spriteData[index].Image.get();
@@ -276,6 +281,7 @@ void SpriteCache::DisposeOldest() {
 	if (!_spriteData[sprnum].IsLocked()) {
 		_cacheSize -= _spriteData[sprnum].Size;
 		_spriteData[sprnum].Image.reset();
+		_stats.Disposed++;
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
 	// Remove from the mru list
@@ -331,6 +337,18 @@ void SpriteCache::PrecacheSprite(sprkey_t index) {
 	SprCacheLog("Precached %d", index);
 }
 
+void SpriteCache::WarmUpSprite(sprkey_t index) {
+	if (index < 0 || (size_t)index >= _spriteData.size())
+		return;
+	if (!_spriteData[index].IsAssetSprite() || _spriteData[index].IsError())
+		return;
+	if (_spriteData[index].Image)
+		return; // already in memory
+
+	if (LoadSprite(index))
+		_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
+}
+
 void SpriteCache::LockSprite(sprkey_t index) {
 	assert(index >= 0); // out of positive range indexes are valid to fail
 	if (index < 0 || (size_t)index >= _spriteData.size())
@@ -364,6 +382,7 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 		return 0;
 	assert((_spriteData[index].Flags & SPRCACHEFLAG_ISASSET) != 0);
 
+	const uint32_t load_start = g_system->getMillis();
 	Bitmap *image;
 	HError err = _file.LoadSprite(index, image);
 	if (!image) {
@@ -396,6 +415,11 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 	_cacheSize += size;
 	SprCacheLog("Loaded %d, size now %zu KB", index, _cacheSize / 1024);
 
+	const uint32_t load_time = g_system->getMillis() - load_start;
+	_stats.Loads++;
+	_stats.LoadTimeMs += load_time;
+	_stats.MaxLoadTimeMs = MAX(_stats.MaxLoadTimeMs, load_time);
+
 	// Let the external user to react to the new sprite;
 	// note that this callback is allowed to modify the sprite's pixels,
 	// but not its size or flags.
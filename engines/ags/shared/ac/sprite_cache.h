@@ -95,6 +95,16 @@ public:
 		PfnPrewriteSprite PrewriteSprite;
 	};
 
+	// Cache usage counters, for diagnostics
+	struct Stats {
+		uint32_t Hits = 0;          // requests served from memory
+		uint32_t Misses = 0;        // requests which had to load the sprite from file
+		uint32_t Loads = 0;         // sprites loaded from file, including precached ones
+		uint32_t Disposed = 0;      // sprites disposed to free cache space
+		uint32_t LoadTimeMs = 0;    // total time spent loading sprites
+		uint32_t MaxLoadTimeMs = 0; // longest single sprite load
+	};
+
 	SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks);
 	~SpriteCache() = default;
 
@@ -138,6 +148,9 @@ public:
 	// Loads sprite using SpriteFile if such index is known,
 	// frees the space if cache size reaches the limit
 	void        PrecacheSprite(sprkey_t index);
+	// Loads sprite into the cache if it's not there yet, without locking it;
+	// lets the caller pay the loading cost before the sprite is first drawn
+	void        WarmUpSprite(sprkey_t index);
 	// Locks sprite, preventing it from getting removed by the normal cache limit.
 	// If this is a registered sprite from the game assets, then loads it first.
 	// If this is a sprite with SPRCACHEFLAG_EXTERNAL flag, then does nothing,
@@ -178,6 +191,11 @@ public:
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Bitmap *operator[](sprkey_t index);
 
+	// Returns cache usage counters
+	const Stats &GetStats() const { return _stats; }
+	// Resets cache usage counters
+	void        ResetStats() { _stats = Stats(); }
+
 private:
 	// Load sprite from game resource
 	size_t      LoadSprite(sprkey_t index, bool lock = false);
@@ -245,6 +263,7 @@ private:
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
 
+	Stats _stats;
 };
 
 } // namespace Shared
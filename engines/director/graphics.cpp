@@ -283,6 +283,9 @@ public:
 	void drawPoint(int x, int y, uint32 src, void *data) override;
 };
 
+template <typename T>
+static inline void inkDrawPixel(T *dst, uint32 src, DirectorPlotData *p);
+
 template <typename T>
 void InkPrimitives<T>::drawPoint(int x, int y, uint32 src, void *data) {
 	DirectorPlotData *p = (DirectorPlotData *)data;
@@ -331,7 +334,16 @@ void InkPrimitives<T>::drawPoint(int x, int y, uint32 src, void *data) {
 
 			*dst = tmpDst;
 		}
-	} else if (p->alpha) {
+	}
+
+	inkDrawPixel<T>(dst, src, p);
+}
+
+template <typename T>
+static inline void inkDrawPixel(T *dst, uint32 src, DirectorPlotData *p) {
+	Graphics::MacWindowManager *wm = p->d->_wm;
+
+	if (p->alpha && !p->ms) {
 		// Sprite blend does not respect colourization; defaults to matte ink
 		byte rSrc, gSrc, bSrc;
 		byte rDst, gDst, bDst;
@@ -701,6 +713,22 @@ void DirectorPlotData::inkBlitShape(Common::Rect &srcRect) {
 	}
 }
 
+template <typename T>
+static void inkBlitSurfaceRows(DirectorPlotData *p, int srcX, int srcY, int w, int h, const Graphics::Surface *mask) {
+	// Pixels are passed straight to inkDrawPixel(), avoiding the bounds
+	// checks and the virtual call of InkPrimitives::drawPoint().
+	for (int i = 0; i < h; i++) {
+		const T *src = (const T *)p->srf->getBasePtr(srcX, srcY + i);
+		const byte *msk = mask ? (const byte *)mask->getBasePtr(srcX, srcY + i) : nullptr;
+		T *dst = (T *)p->dst->getBasePtr(p->destRect.left, p->destRect.top + i);
+
+		for (int j = 0; j < w; j++, src++, dst++) {
+			if (!mask || (msk && (*msk++)))
+				inkDrawPixel<T>(dst, p->preprocessColor(*src), p);
+		}
+	}
+}
+
 void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!srf)
 		return;
@@ -735,30 +763,20 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 	// format as the window manager. Most of the time this is
 	// the job of BitmapCastMember::createWidget.
 
-	Graphics::Primitives *primitives = g_director->getInkPrimitives();
-
-	srcPoint.y = abs(srcRect.top - destRect.top);
-	for (int i = 0; i < destRect.height(); i++, srcPoint.y++) {
-		srcPoint.x = abs(srcRect.left - destRect.left);
-		const byte *msk = mask ? (const byte *)mask->getBasePtr(srcPoint.x, srcPoint.y) : nullptr;
+	// The source offsets only grow, so anything outside of the surface
+	// is on the right or bottom edge and can be clipped away up front
+	int srcX = abs(srcRect.left - destRect.left);
+	int srcY = abs(srcRect.top - destRect.top);
+	int w = CLIP<int>(srfClip.right - srcX, 0, destRect.width());
+	int h = CLIP<int>(srfClip.bottom - srcY, 0, destRect.height());
 
-		for (int j = 0; j < destRect.width(); j++, srcPoint.x++) {
-			if (!srfClip.contains(srcPoint)) {
-				failedBoundsCheck = true;
-				continue;
-			}
+	if (!destRect.isEmpty() && (w < destRect.width() || h < destRect.height()))
+		failedBoundsCheck = true;
 
-			if (!mask || (msk && (*msk++))) {
-				if (d->_wm->_pixelformat.bytesPerPixel == 1) {
-					primitives->drawPoint(destRect.left + j, destRect.top + i,
-										preprocessColor(*((byte *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
-				} else {
-					primitives->drawPoint(destRect.left + j, destRect.top + i,
-										preprocessColor(*((uint32 *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
-				}
-			}
-		}
-	}
+	if (d->_wm->_pixelformat.bytesPerPixel == 1)
+		inkBlitSurfaceRows<byte>(this, srcX, srcY, w, h, mask);
+	else
+		inkBlitSurfaceRows<uint32>(this, srcX, srcY, w, h, mask);
 
 	if (failedBoundsCheck) {
 		warning("DirectorPlotData::inkBlitSurface: Out of bounds - srfClip: %d,%d,%d,%d, srcRect: %d,%d,%d,%d, dstRect: %d,%d,%d,%d",
@@ -185,7 +185,7 @@ void Lingo::cleanupFuncs() {
 }
 
 void Lingo::push(Datum d) {
-	_state->stack.push_back(d);
+	_state->stack.push_back(Common::move(d));
 }
 
 Datum Lingo::getVoid() {
@@ -203,7 +203,7 @@ void Lingo::pushVoid() {
 Datum Lingo::pop() {
 	assert (_state->stack.size() != 0);
 
-	Datum ret = _state->stack.back();
+	Datum ret = Common::move(_state->stack.back());
 	_state->stack.pop_back();
 
 	return ret;
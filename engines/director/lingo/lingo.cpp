@@ -618,6 +618,9 @@ Common::String Lingo::formatFunctionBody(Symbol &sym) {
 
 bool Lingo::execute(int targetFrame) {
 	uint localCounter = 0;
+	// The few-frames-only channel is set from the command line; checking it
+	// means a hash lookup, so do it once here rather than for every instruction.
+	bool fewFramesOnly = debugChannelSet(-1, kDebugFewFramesOnly);
 
 	while (!_abort && !_freezeState && !_playDone && _state->script && (*_state->script)[_state->pc] != STOP) {
 		if (targetFrame != -1 && (int)_state->callstack.size() == targetFrame)
@@ -636,7 +639,7 @@ bool Lingo::execute(int targetFrame) {
 			}
 		}
 
-		if (_globalCounter > 1000 && debugChannelSet(-1, kDebugFewFramesOnly)) {
+		if (fewFramesOnly && _globalCounter > 1000) {
 			warning("Lingo::execute(): Stopping due to debug few frames only");
 			_vm->getCurrentMovie()->getScore()->_playState = kPlayStopped;
 			break;
@@ -868,26 +871,49 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool equality) {
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Datum &d) {
+	type = d.type;
+	u = d.u;
+	refCount = d.shareRefCount();
+	ignoreGlobal = false;
+}
+
+Datum::Datum(Datum &&d) {
 	type = d.type;
 	u = d.u;
 	refCount = d.refCount;
-	*refCount += 1;
 	ignoreGlobal = false;
+
+	d.type = VOID;
+	d.u.s = nullptr;
+	d.refCount = nullptr;
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (refCount != d.refCount || !refCount)) {
+		reset();
+		type = d.type;
+		u = d.u;
+		refCount = d.shareRefCount();
+	}
+	ignoreGlobal = false;
+	return *this;
+}
+
+Datum& Datum::operator=(Datum &&d) {
+	if (this != &d) {
 		reset();
 		type = d.type;
 		u = d.u;
 		refCount = d.refCount;
-		*refCount += 1;
+
+		d.type = VOID;
+		d.u.s = nullptr;
+		d.refCount = nullptr;
 	}
 	ignoreGlobal = false;
 	return *this;
@@ -896,16 +922,14 @@ Datum& Datum::operator=(const Datum &d) {
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -925,8 +949,7 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
@@ -939,8 +962,7 @@ Datum::Datum(CastMember *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
@@ -975,16 +997,47 @@ Datum::Datum(const Common::Rect &rect) {
 	ignoreGlobal = false;
 }
 
-void Datum::reset() {
-	if (!refCount)
-		return;
+int *Datum::shareRefCount() const {
+	if (refCount) {
+		*refCount += 1;
+		return refCount;
+	}
 
-	*refCount -= 1;
+	// Values without payload need no counter, every copy is independent
+	if (!hasPayload())
+		return nullptr;
+
+	// The payload was attached after construction and is only owned by us
+	// so far, start counting now that it gets shared
+	refCount = new int;
+	*refCount = 2;
+	return refCount;
+}
+
+bool Datum::hasPayload() const {
+	switch (type) {
+	case VOID:
+	case INT:
+	case FLOAT:
+	case ARGC:
+	case ARGCNORET:
+	case CASTLIBREF:
+	case SPRITEREF:
+		return false;
+	default:
+		return u.s != nullptr;
+	}
+}
+
+void Datum::reset() {
+	// A missing refCount means that we are the sole owner
+	if (refCount)
+		*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
 	// (correctly) that there are cases when refCount == 0
 	// Thus, DO NOT COMPILE, trick it and shut tons of false positives
 #ifndef __COVERITY__
-	if (*refCount <= 0) {
+	if (!refCount || *refCount <= 0) {
 		switch (type) {
 		case VOID:
 		case INT:
@@ -1016,7 +1069,8 @@ void Datum::reset() {
 		case OBJECT:
 			if (u.obj->getObjType() == kWindowObj) {
 				// Window has an override for decRefCount, use it directly
-				*refCount += 1;
+				if (refCount)
+					*refCount += 1;
 				static_cast<Window *>(u.obj)->decRefCount();
 			} else {
 				// *refCount is copied between the Datum and the Object,
@@ -1045,6 +1099,7 @@ void Datum::reset() {
 			delete refCount;
 	}
 #endif
+	refCount = nullptr;
 }
 
 Datum Datum::eval() const {
@@ -1696,11 +1751,14 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
-				g_debugger->varWriteHook(name);
-				return;
+			const Common::String &name = *var.u.s;
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end()) {
+					it->_value = value;
+					g_debugger->varWriteHook(name);
+					return;
+				}
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				_state->me.u.obj->setProp(name, value);
@@ -1720,9 +1778,10 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
+			const Common::String &name = *var.u.s;
+			DatumHash::iterator it;
+			if (_state->localVars && (it = _state->localVars->find(name)) != _state->localVars->end()) {
+				it->_value = value;
 				g_debugger->varWriteHook(name);
 			} else {
 				warning("varAssign: local variable %s not defined", name.c_str());
@@ -1812,18 +1871,20 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Datum d;
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
 
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			if (_state->localVars) {
+				DatumHash::const_iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end())
+					return it->_value;
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::const_iterator git = _globalvars.find(name);
+			if (git != _globalvars.end()) {
+				return git->_value;
 			}
 
 			if (!silent)
@@ -1833,10 +1894,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case GLOBALREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: global variable %s not defined", name.c_str());
 			return result;
@@ -1844,10 +1906,12 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			if (_state->localVars) {
+				DatumHash::const_iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end())
+					return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -1855,7 +1919,7 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
@@ -143,13 +143,17 @@ struct Datum {	/* interpreter stack type */
 		PictureReference *picture; /* PICTUREREF */
 	} u;
 
-	int *refCount;
+	// Shared by all copies of a payload. Allocated lazily on first copy,
+	// so that plain values like INT and FLOAT never touch the heap.
+	mutable int *refCount;
 
 	bool ignoreGlobal; // True if this Datum should be ignored by showGlobals and clearGlobals
 
 	Datum();
 	Datum(const Datum &d);
+	Datum(Datum &&d);
 	Datum& operator=(const Datum &d);
+	Datum& operator=(Datum &&d);
 	Datum(int val);
 	Datum(double val);
 	Datum(const Common::String &val);
@@ -188,6 +192,10 @@ struct Datum {	/* interpreter stack type */
 	bool operator<(const Datum &d) const;
 	bool operator>=(const Datum &d) const;
 	bool operator<=(const Datum &d) const;
+
+private:
+	int *shareRefCount() const;
+	bool hasPayload() const;
 };
 
 struct ChunkReference {
@@ -718,6 +718,11 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 
 	Common::Rect r(MAX(1, t.xStepSize), t.yStepSize);
 
+	// Single pixel cells are copied directly, copyRectToSurface() would
+	// spend most of the time on clipping and call overhead
+	bool singlePixel = t.xStepSize == 1 && t.yStepSize == 1;
+	int bpp = g_director->_pixelformat.bytesPerPixel;
+
 	int bitIndex = -1;
 	for (int i = 0; i < t.steps; i++) {
 		uint32 startTime = g_system->getMillis();
@@ -742,11 +747,19 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 						if (x < realw && y < realh) {
 							x += clipRect.left;
 							y += clipRect.top;
-							r.moveTo(x, y);
-							r.clip(clipRect);
 
-							if (!r.isEmpty())
-								_composeSurface->copyRectToSurface(*nextFrame, x, y, r);
+							if (singlePixel) {
+								if (bpp == 1)
+									*(byte *)_composeSurface->getBasePtr(x, y) = *(const byte *)nextFrame->getBasePtr(x, y);
+								else
+									*(uint32 *)_composeSurface->getBasePtr(x, y) = *(const uint32 *)nextFrame->getBasePtr(x, y);
+							} else {
+								r.moveTo(x, y);
+								r.clip(clipRect);
+
+								if (!r.isEmpty())
+									_composeSurface->copyRectToSurface(*nextFrame, x, y, r);
+							}
 						}
 					} else {
 						mask = pixmask[x % -t.xStepSize];
@@ -870,6 +883,17 @@ void Window::dissolvePatternsTrans(TransParams &t, Common::Rect &clipRect, Graph
 		uint32 startTime = g_system->getMillis();
 		for (int y = clipRect.top; y < clipRect.bottom; y++) {
 			byte pat = dissolvePatterns[patternIndex][y % 8];
+
+			// Empty and full rows need no per-pixel masking
+			if (pat == 0x00)
+				continue;
+
+			if (pat == 0xff) {
+				Common::Rect row(clipRect.left, y, clipRect.right, y + 1);
+				_composeSurface->copyRectToSurface(*nextFrame, clipRect.left, y, row);
+				continue;
+			}
+
 			if (g_director->_pixelformat.bytesPerPixel == 1) {
 
 				byte *dst = (byte *)_composeSurface->getBasePtr(clipRect.left, y);
@@ -199,12 +199,30 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 			}
 		}
 
-		if (shouldClear) {
-			blitTo->fillRect(r, _stageColor);
-		} else if (trailChannel) {
+		if (trailChannel) {
 			// Trail rendering mode; do not re-render the background and sprites underneath.
 			_dirtyChannels.clear();
 			_dirtyChannels.push_back(trailChannel);
+		} else {
+			// Everything drawn underneath the topmost sprite which fully
+			// covers the rect would be overwritten anyway, so skip it.
+			// Direct-to-stage video is drawn last and can't be culled.
+			Common::List<Channel *>::iterator occluder = _dirtyChannels.end();
+			for (Common::List<Channel *>::iterator j = _dirtyChannels.begin(); j != _dirtyChannels.end(); ++j) {
+				if (!((*j)->isActiveVideo() && (*j)->isVideoDirectToStage()) && coversRect(*j, r))
+					occluder = j;
+			}
+
+			if (occluder != _dirtyChannels.end()) {
+				for (Common::List<Channel *>::iterator j = _dirtyChannels.begin(); j != occluder;) {
+					if ((*j)->isActiveVideo() && (*j)->isVideoDirectToStage())
+						++j;
+					else
+						j = _dirtyChannels.erase(j);
+				}
+			} else if (shouldClear) {
+				blitTo->fillRect(r, _stageColor);
+			}
 		}
 
 		for (int pass = 0; pass < 2; pass++) {
@@ -361,6 +379,31 @@ void Window::inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::Mana
 	}
 }
 
+bool Window::coversRect(Channel *channel, const Common::Rect &r) {
+	if (!channel->_visible || channel->hasSubChannels())
+		return false;
+
+	Common::Rect bbox = channel->getBbox();
+	if (!bbox.contains(r))
+		return false;
+
+	// Only sprites going through the plain copy fast path in
+	// DirectorPlotData::inkBlitSurface() overwrite every pixel, and only
+	// if the surface is opaque. The fast path uses blitFrom(), which
+	// skips fully transparent source pixels and blends translucent ones,
+	// so surfaces with an alpha channel (i.e. in 32bpp mode) never count.
+	DirectorPlotData pd = channel->getPlotData();
+	if (!pd.srf || pd.ms || pd.applyColor || pd.alpha || pd.ink != kInkTypeCopy)
+		return false;
+
+	if (pd.srf->format.aBits() != 0)
+		return false;
+
+	Common::Rect offsetRect(r.width(), r.height());
+	offsetRect.moveTo(r.left - bbox.left, r.top - bbox.top);
+	return pd.srf->getBounds().contains(offsetRect);
+}
+
 Common::Point Window::getMousePos() {
 	return g_system->getEventManager()->getMousePos() - Common::Point(_innerDims.left, _innerDims.top);
 }
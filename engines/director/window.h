@@ -231,6 +231,7 @@ private:
 private:
 	static void drawChannelBox(Director::Movie *currentMovie, Graphics::ManagedSurface *blitTo, int selectedChannel);
 	void drawFrameCounter(Graphics::ManagedSurface *blitTo);
+	static bool coversRect(Channel *channel, const Common::Rect &r);
 
 
 };
@@ -72,7 +72,6 @@ public:
 };
 
 ResourceLoader::ResourceLoader() {
-	_cacheDirty = false;
 	_cacheMemorySize = 0;
 
 	Lab *l;
@@ -230,10 +229,8 @@ void clearList(Common::List<T> &list) {
 }
 
 ResourceLoader::~ResourceLoader() {
-	for (Common::Array<ResourceCache>::iterator i = _cache.begin(); i != _cache.end(); ++i) {
-		ResourceCache &r = *i;
-		delete[] r.fname;
-		delete[] r.resPtr;
+	for (CacheMap::iterator i = _cache.begin(); i != _cache.end(); ++i) {
+		delete[] i->_value.resPtr;
 	}
 	clearList(_models);
 	clearList(_colormaps);
@@ -242,10 +239,6 @@ ResourceLoader::~ResourceLoader() {
 	MD5Check::clear();
 }
 
-static int sortCallback(const void *entry1, const void *entry2) {
-	return scumm_stricmp(((const ResourceLoader::ResourceCache *)entry1)->fname, ((const ResourceLoader::ResourceCache *)entry2)->fname);
-}
-
 Common::SeekableReadStream *ResourceLoader::getFileFromCache(const Common::Path &filename) const {
 	ResourceLoader::ResourceCache *entry = getEntryFromCache(filename);
 	if (!entry)
@@ -258,17 +251,11 @@ ResourceLoader::ResourceCache *ResourceLoader::getEntryFromCache(const Common::P
 	if (_cache.empty())
 		return nullptr;
 
-	if (_cacheDirty) {
-		qsort(_cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
-		_cacheDirty = false;
-	}
-
-	Common::String sFilename(filename.toString('/'));
-
-	ResourceCache key;
-	key.fname = const_cast<char *>(sFilename.c_str());
+	CacheMap::iterator i = _cache.find(filename.toString('/'));
+	if (i == _cache.end())
+		return nullptr;
 
-	return (ResourceLoader::ResourceCache *)bsearch(&key, _cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
+	return &i->_value;
 }
 
 Common::SeekableReadStream *ResourceLoader::loadFile(const Common::Path &filename) const {
@@ -309,16 +296,11 @@ Common::SeekableReadStream *ResourceLoader::openNewStreamFile(const Common::Stri
 }
 
 void ResourceLoader::putIntoCache(const Common::Path &fname, byte *res, uint32 len) const {
-	Common::String sFilename(fname.toString('/'));
-
 	ResourceCache entry;
 	entry.resPtr = res;
 	entry.len = len;
-	entry.fname = new char[sFilename.size() + 1];
-	Common::strcpy_s(entry.fname, sFilename.size() + 1, sFilename.c_str());
 	_cacheMemorySize += len;
-	_cache.push_back(entry);
-	_cacheDirty = true;
+	_cache[fname.toString('/')] = entry;
 }
 
 CMap *ResourceLoader::loadColormap(const Common::String &filename) {
@@ -602,21 +584,11 @@ Overlay *ResourceLoader::loadOverlay(const Common::String &filename) {
 void ResourceLoader::uncache(const Common::Path &filename) const {
 	Common::Path lower(filename);
 	lower.toLowercase();
-	Common::String fname(lower.toString('/'));
-
-	if (_cacheDirty) {
-		qsort(_cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
-		_cacheDirty = false;
-	}
-
-	for (unsigned int i = 0; i < _cache.size(); i++) {
-		if (fname.equals(_cache[i].fname)) {
-			delete[] _cache[i].fname;
-			_cacheMemorySize -= _cache[i].len;
-			delete[] _cache[i].resPtr;
-			_cache.remove_at(i);
-			_cacheDirty = true;
-		}
+	CacheMap::iterator i = _cache.find(lower.toString('/'));
+	if (i != _cache.end()) {
+		_cacheMemorySize -= i->_value.len;
+		delete[] i->_value.resPtr;
+		_cache.erase(i);
 	}
 }
 
@@ -24,6 +24,7 @@
 
 #include "common/archive.h"
 #include "common/array.h"
+#include "common/hashmap.h"
 
 #include "engines/grim/object.h"
 
@@ -86,7 +87,6 @@ public:
 	void uncacheAnimationEmi(AnimationEmi *a);
 
 	struct ResourceCache {
-		char *fname;
 		byte *resPtr;
 		uint32 len;
 	};
@@ -100,8 +100,8 @@ private:
 	void putIntoCache(const Common::Path &fname, byte *res, uint32 len) const;
 	void uncache(const Common::Path &fname) const;
 
-	mutable Common::Array<ResourceCache> _cache;
-	mutable bool _cacheDirty;
+	typedef Common::HashMap<Common::String, ResourceCache, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CacheMap;
+	mutable CacheMap _cache;
 	mutable int32 _cacheMemorySize;
 
 	Common::List<EMIModel *> _emiModels;
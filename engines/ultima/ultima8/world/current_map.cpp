@@ -1000,6 +1000,14 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 		   vel[0] - ext[0], vel[1] - ext[1], vel[2] - ext[2],
 		   vel[0] + ext[0], vel[1] + ext[1], vel[2] + ext[2]);
 
+	// Items are stored by their maximum x/y and minimum z corner, so an
+	// item below or behind the swept box can be rejected from its location
+	// alone. The margin covers the rounding of the hit times below, which
+	// can reach past the end of very long sweeps.
+	const int32 sweepMinX = MIN(start.x, end.x) - dims[0] - (ABS(vel[0]) / 0x4000 + 1);
+	const int32 sweepMinY = MIN(start.y, end.y) - dims[1] - (ABS(vel[1]) / 0x4000 + 1);
+	const int32 sweepMaxZ = MAX(start.z, end.z) + dims[2] + (ABS(vel[2]) / 0x4000 + 1);
+
 	Std::list<SweepItem>::iterator sw_it;
 	if (hit) sw_it = hit->end();
 
@@ -1011,6 +1019,10 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 				if (other_item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
+				Point3 opt = other_item->getLocation();
+				if (opt.x < sweepMinX || opt.y < sweepMinY || opt.z > sweepMaxZ)
+					continue;
+
 				uint32 othershapeflags = other_item->getShapeInfo()->_flags;
 				bool blocking = (othershapeflags & shapeflags &
 				                 blockflagmask) != 0;
@@ -1021,7 +1033,6 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 					continue;
 
 				int32 other[3], oext[3];
-				Point3 opt = other_item->getLocation();
 				other[0] = opt.x;
 				other[1] = opt.y;
 				other[2] = opt.z;
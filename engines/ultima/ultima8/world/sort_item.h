@@ -188,7 +188,14 @@ struct SortItem {
 			unused = unused->_next;
 			nn->val = other;
 
-			for (Node *n = list; n != nullptr; n = n->_next) {
+			// ItemSorter::AddItem visits items in list order, so most
+			// insertions belong at the end. The list is sorted, so if we are
+			// not less than the tail we aren't less than anything before it.
+			Node *n = list;
+			if (tail && !other->listLessThan(*(tail->val)))
+				n = nullptr;
+
+			for (; n != nullptr; n = n->_next) {
 				// Get the insert point... which is before the first item that has higher z than us
 				if (other->listLessThan(*(n->val))) {
 					nn->_next = n;
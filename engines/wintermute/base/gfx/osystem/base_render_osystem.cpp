@@ -154,7 +154,7 @@ bool BaseRenderOSystem::flip() {
 		_needsFlip = false;
 
 		// Reset ticketing state
-		_lastFrameIter = _renderQueue.end();
+		resetLastFrameIter();
 		RenderQueueIterator it;
 		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 			(*it)->_wantsDraw = false;
@@ -192,7 +192,7 @@ bool BaseRenderOSystem::flip() {
 		_dirtyRect = nullptr;
 		_needsFlip = false;
 	}
-	_lastFrameIter = _renderQueue.end();
+	resetLastFrameIter();
 
 	g_system->updateScreen();
 
@@ -272,6 +272,12 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
+		// Nothing left in the queue can match, so don't bother looking.
+		Common::HashMap<uint, uint>::iterator pending = _pendingTickets.find(compare.getHash());
+		if (pending == _pendingTickets.end() || pending->_value == 0) {
+			drawFromTicket(new RenderTicket(owner, surf, srcRect, dstRect, transform));
+			return;
+		}
 		RenderQueueIterator it = _lastFrameIter;
 		++it;
 		// Avoid calling end() and operator* every time, when potentially going through
@@ -281,6 +287,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		for (; it != endIterator; ++it) {
 			compareTicket = *it;
 			if (*(compareTicket) == compare && compareTicket->_isValid) {
+				pending->_value--;
 				if (_disableDirtyRects) {
 					drawFromSurface(compareTicket);
 				} else {
@@ -439,6 +446,14 @@ void BaseRenderOSystem::drawTickets() {
 
 }
 
+void BaseRenderOSystem::resetLastFrameIter() {
+	_lastFrameIter = _renderQueue.end();
+	_pendingTickets.clear();
+	for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		_pendingTickets[(*it)->getHash()]++;
+	}
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void BaseRenderOSystem::drawFromSurface(RenderTicket *ticket) {
 	ticket->drawToSurface(_renderSurface);
@@ -537,7 +552,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
-	_lastFrameIter = _renderQueue.end();
+	resetLastFrameIter();
 
 	_renderSurface->fillRect(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
 	g_system->fillScreen(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
@@ -32,6 +32,7 @@
 
 #include "common/rect.h"
 #include "common/list.h"
+#include "common/hashmap.h"
 
 #include "graphics/managed_surface.h"
 #include "graphics/transform_struct.h"
@@ -127,11 +128,18 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
+	/**
+	 * Start matching against the whole queue again, for the next frame.
+	 */
+	void resetLastFrameIter();
 	Common::Rect *_dirtyRect;
 	Common::List<RenderTicket *> _renderQueue;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
+	// Number of tickets after _lastFrameIter per ticket hash, so that new
+	// tickets can skip searching the rest of the queue for a match.
+	Common::HashMap<uint, uint> _pendingTickets;
 	Common::Rect _renderRect;
 	Graphics::ManagedSurface *_renderSurface;
 
@@ -44,6 +44,16 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	        _isValid(true),
 	        _wantsDraw(true),
 	        _transform(transform) {
+	_hash = (uint)(size_t)owner;
+	_hash = _hash * 31 + (uint16)_dstRect.left;
+	_hash = _hash * 31 + (uint16)_dstRect.top;
+	_hash = _hash * 31 + (uint16)_dstRect.right;
+	_hash = _hash * 31 + (uint16)_dstRect.bottom;
+	_hash = _hash * 31 + (uint16)_srcRect.left;
+	_hash = _hash * 31 + (uint16)_srcRect.top;
+	_hash = _hash * 31 + (uint16)_srcRect.right;
+	_hash = _hash * 31 + (uint16)_srcRect.bottom;
+
 	if (surf) {
 		assert(surf->format.bytesPerPixel == 4);
 
@@ -81,7 +91,8 @@ RenderTicket::~RenderTicket() {
 }
 
 bool RenderTicket::operator==(const RenderTicket &t) const {
-	if ((t._owner != _owner) ||
+	if ((t._hash != _hash) ||
+		(t._owner != _owner) ||
 		(t._transform != _transform)  ||
 		(t._dstRect != _dstRect) ||
 		(t._srcRect != _srcRect)
@@ -51,7 +51,7 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _owner(nullptr), _surface(nullptr), _hash(0) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -69,9 +69,16 @@ public:
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
+	/**
+	 * Hash of the owner and the source/destination rects. Equal tickets
+	 * always have equal hashes, so this can be used to rule out matches
+	 * without doing the full comparison.
+	 */
+	uint getHash() const { return _hash; }
 private:
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
+	uint _hash;
 };
 
 } // End of namespace Wintermute
@@ -219,9 +219,13 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 	if (DID_FAIL(ret)) {
 		ScValue *newVal = nullptr;
 
-		_valIter = _valObject.find(name);
-		if (_valIter != _valObject.end()) {
-			newVal = _valIter->_value;
+		// Build the key only once, and reuse the slot if it already exists.
+		// A local iterator is used since copy() may walk our own properties
+		// through _valIter when val is this very object.
+		Common::String key(name);
+		Common::HashMap<Common::String, ScValue *>::iterator slot = _valObject.find(key);
+		if (slot != _valObject.end()) {
+			newVal = slot->_value;
 		}
 		if (!newVal) {
 			newVal = new ScValue(_game);
@@ -231,7 +235,11 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
+		if (slot != _valObject.end()) {
+			slot->_value = newVal;
+		} else {
+			_valObject[key] = newVal;
+		}
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -446,14 +454,25 @@ void ScValue::setString(const Common::String &val) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::setStringVal(const char *val) {
-	delete[] _valString;
+	if (val == _valString) {
+		return;
+	}
 
 	if (val == nullptr) {
+		delete[] _valString;
 		_valString = nullptr;
 		return;
 	}
 
 	size_t valSize = strlen(val) + 1;
+	// Scripts keep reassigning strings of similar length, so reuse the
+	// current buffer when the new value fits into it
+	if (_valString && strlen(_valString) + 1 >= valSize) {
+		memmove(_valString, val, valSize);
+		return;
+	}
+
+	delete[] _valString;
 	_valString = new char[valSize];
 	Common::strcpy_s(_valString, valSize, val);
 }
@@ -736,8 +755,9 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
-			_valObject[orig->_valIter->_key] = new ScValue(_game);
-			_valObject[orig->_valIter->_key]->copy(orig->_valIter->_value);
+			ScValue *newVal = new ScValue(_game);
+			_valObject[orig->_valIter->_key] = newVal;
+			newVal->copy(orig->_valIter->_value);
 			orig->_valIter++;
 		}
 	} else {
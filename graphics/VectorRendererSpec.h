@@ -287,20 +287,45 @@ protected:
 	 * @param alpha Alpha intensity of the pixel (0-255)
 	 */
 	inline void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
-		while (first < last)
-			blendPixelPtr(first++, color, alpha);
+		if (alpha == 0)
+			return;
+
+		if (alpha == 0xff) {
+			const PixelType opaque = color | _alphaMask;
+			while (first < last)
+				*first++ = opaque;
+			return;
+		}
+
+		// Spans are mostly blended over flat backgrounds, so reuse the
+		// result while the destination doesn't change
+		PixelType lastDst = 0, lastResult = 0;
+		bool haveLast = false;
+		while (first < last) {
+			if (haveLast && *first == lastDst) {
+				*first++ = lastResult;
+				continue;
+			}
+			lastDst = *first;
+			blendPixelPtr(first, color, alpha);
+			lastResult = *first++;
+			haveLast = true;
+		}
 	}
 
 	inline void blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY) {
-		if (_clippingArea.top <= realY && realY < _clippingArea.bottom) {
-			while (first < last) {
-				if (_clippingArea.left <= realX && realX < _clippingArea.right)
-					blendPixelPtr(first++, color, alpha);
-				else
-					++first;
-				++realX;
-			}
+		if (realY < _clippingArea.top || realY >= _clippingArea.bottom)
+			return;
+
+		// Clip the span once instead of checking every pixel
+		if (realX < _clippingArea.left) {
+			first += _clippingArea.left - realX;
+			realX = _clippingArea.left;
 		}
+		if (last - first > _clippingArea.right - realX)
+			last = first + (_clippingArea.right - realX);
+
+		blendFill(first, last, color, alpha);
 	}
 
 	void darkenFill(PixelType *first, PixelType *last);
@@ -610,6 +610,16 @@ static void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos,
 	uint8 sA, sR, sG, sB;
 	dstFormat.colorToRGB(color, sR, sG, sB);
 
+	// The blending below is expensive, and text is mostly drawn over flat
+	// backgrounds. Remember the blended colors for the current destination
+	// color, indexed by coverage. An entry is valid if it carries the
+	// current generation, which saves clearing the table.
+	ColorType blendDst = 0;
+	ColorType blendColor[256];
+	uint16 blendGen[256];
+	uint16 gen = 0;
+	memset(blendGen, 0, sizeof(blendGen));
+
 	for (int y = 0; y < h; ++y) {
 		ColorType *rDst = (ColorType *)dstPos;
 		const uint8 *src = srcPos;
@@ -620,6 +630,19 @@ static void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos,
 			} else if (*src) {
 				sA = *src;
 
+				if (gen == 0 || *rDst != blendDst) {
+					blendDst = *rDst;
+					if (++gen == 0) {
+						memset(blendGen, 0, sizeof(blendGen));
+						gen = 1;
+					}
+				} else if (blendGen[sA] == gen) {
+					*rDst = blendColor[sA];
+					++rDst;
+					++src;
+					continue;
+				}
+
 				uint8 dA, dR, dG, dB;
 				if (transparentColor && *rDst == *transparentColor) {
 					dA = dR = dG = dB = 0;
@@ -637,6 +660,8 @@ static void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos,
 				dA = static_cast<uint8>(oAn * 255.0);
 
 				*rDst = dstFormat.ARGBToColor(dA, dR, dG, dB);
+				blendColor[sA] = *rDst;
+				blendGen[sA] = gen;
 			}
 
 			++rDst;
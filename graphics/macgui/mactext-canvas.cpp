@@ -976,14 +976,21 @@ int MacTextCanvas::getLineHeight(int line) {
 	return _text[line].height;
 }
 
-void MacTextCanvas::recalcDims() {
+void MacTextCanvas::recalcDims(int fromLine) {
 	if (_text.empty())
 		return;
 
-	int y = 0;
+	fromLine = CLIP<int>(fromLine, 0, _text.size() - 1);
+
+	int y = fromLine ? _text[fromLine].y : 0;
 	_textMaxWidth = 0;
 
-	for (uint i = 0; i < _text.size(); i++) {
+	// Lines before fromLine are unchanged, so their cached dimensions
+	// are still valid. This keeps appending to long texts cheap.
+	for (int i = 0; i < fromLine; i++)
+		_textMaxWidth = MAX(_textMaxWidth, getLineWidth(i));
+
+	for (uint i = fromLine; i < _text.size(); i++) {
 		_text[i].y = y;
 
 		// We must calculate width first, because it enforces
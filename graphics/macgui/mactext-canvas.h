@@ -128,7 +128,7 @@ public:
 public:
 	~MacTextCanvas();
 
-	void recalcDims();
+	void recalcDims(int fromLine = 0);
 	void reallocSurface();
 	void render(int from, int to);
 	void render(int from, int to, int shadow);
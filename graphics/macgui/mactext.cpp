@@ -668,8 +668,8 @@ void MacText::setInterLinear(int interLinear) {
 	_contentIsDirty = true;
 }
 
-void MacText::recalcDims() {
-	_canvas.recalcDims();
+void MacText::recalcDims(int fromLine) {
+	_canvas.recalcDims(fromLine);
 
 	if (!_fixedDims) {
 		int newBottom = _dims.top + _canvas._textMaxHeight + (2 * _border) + _gutter + _shadow;
@@ -678,6 +678,14 @@ void MacText::recalcDims() {
 			delete _composeSurface;
 			_composeSurface = new ManagedSurface(_dims.width(), _dims.height(), _wm->_pixelformat);
 			_canvas.reallocSurface();
+
+			// When appending, reallocSurface() preserves the already
+			// rendered lines, and the caller renders the new ones
+			if (fromLine > 0) {
+				_contentIsDirty = true;
+				return;
+			}
+
 			if (!_fullRefresh) {
 				_fullRefresh = true;
 				render();
@@ -822,10 +830,14 @@ void MacText::appendText(const Common::U32String &str, const Font *font, uint16
 void MacText::appendText_(const Common::U32String &strWithFont, uint oldLen) {
 	clearChunkInput();
 
+	// splitString() continues the last line, which may precede oldLen - 1
+	// if empty lines were removed
+	int firstLine = MIN<int>(oldLen, _canvas._text.size()) - 1;
+
 	_canvas.splitString(strWithFont, -1, _defaultFormatting);
-	recalcDims();
+	recalcDims(firstLine);
 
-	_canvas.render(oldLen - 1, _canvas._text.size());
+	_canvas.render(firstLine, _canvas._text.size());
 
 	_contentIsDirty = true;
 
@@ -849,7 +861,7 @@ void MacText::appendTextDefault(const Common::U32String &str, bool skipAdd) {
 		_str += strWithFont;
 	}
 	_canvas.splitString(strWithFont, -1, _defaultFormatting);
-	recalcDims();
+	recalcDims(oldLen - 1);
 
 	_canvas.render(oldLen - 1, _canvas._text.size());
 }
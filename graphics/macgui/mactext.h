@@ -194,7 +194,7 @@ private:
 	void init(uint32 fgcolor, uint32 bgcolor, int maxWidth, TextAlign textAlignment, int interlinear, uint16 textShadow, bool macFontMode);
 	bool isCutAllowed();
 
-	void recalcDims();
+	void recalcDims(int fromLine = 0);
 
 	void drawSelection(int xoff, int yoff);
 	void updateCursorPos();
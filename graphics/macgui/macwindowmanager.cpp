@@ -912,6 +912,20 @@ void MacWindowManager::drawDesktop() {
 	}
 }
 
+// Checks whether the area is fully covered by the inner part of a
+// visible window higher in the stack. Callers must make sure the inner
+// parts are drawn opaquely.
+static bool isCoveredFromAbove(const Common::List<BaseMacWindow *> &stack, Common::List<BaseMacWindow *>::const_iterator it, const Common::Rect &area) {
+	for (++it; it != stack.end(); ++it) {
+		BaseMacWindow *w = *it;
+
+		if (w->isVisible() && w->getType() == kWindowWindow && w->getInnerDimensions().contains(area))
+			return true;
+	}
+
+	return false;
+}
+
 void MacWindowManager::draw() {
 	Common::StackLock lock(_mutex);
 
@@ -940,6 +954,12 @@ void MacWindowManager::draw() {
 			_redrawEngineCallback(_engineR);
 	}
 
+	// Inner window areas are only opaque when copied straight to the
+	// screen, or when blitting to _screen with a format without alpha.
+	// Otherwise blitFrom() skips transparent pixels and blends translucent
+	// ones, so windows underneath may show through.
+	bool opaqueWindows = !_screen || _pixelformat.aBits() == 0;
+
 	Common::Array<Common::Rect> dirtyRects;
 	for (Common::List<BaseMacWindow *>::const_iterator it = _windowStack.begin(); it != _windowStack.end(); it++) {
 		BaseMacWindow *w = *it;
@@ -958,6 +978,11 @@ void MacWindowManager::draw() {
 		if (clip.isEmpty())
 			continue;
 
+		// Nothing of this window would be visible, so skip redrawing it.
+		// It stays dirty until it gets uncovered.
+		if (opaqueWindows && isCoveredFromAbove(_windowStack, it, clip))
+			continue;
+
 		bool forceRedraw = _fullRefresh;
 		if (!forceRedraw && dirtyRects.size()) {
 			for (auto &dirty : dirtyRects) {
@@ -976,27 +1001,23 @@ void MacWindowManager::draw() {
 				Common::Rect innerDims = w->getInnerDimensions();
 				int adjWidth, adjHeight;
 
-				if (w->isDirty() || forceRedraw) {
-					w->draw(forceRedraw);
-
-					adjustDimensions(clip, outerDims, adjWidth, adjHeight);
-
-					if (_pixelformat.bytesPerPixel == 1) {
-						Surface *surface = g_system->lockScreen();
-						ManagedSurface *border = w->getBorderSurface();
+				adjustDimensions(clip, outerDims, adjWidth, adjHeight);
 
-						for (int y = 0; y < adjHeight; y++) {
-							const byte *src = (const byte *)border->getBasePtr(clip.left - outerDims.left, y);
-							byte *dst = (byte *)surface->getBasePtr(clip.left, y + clip.top);
-							for (int x = 0; x < adjWidth; x++, src++, dst++)
-									if (*src != _colorGreen2 && *src != _colorGreen)
-										*dst = *src;
-						}
-
-						g_system->unlockScreen();
-					} else {
-						g_system->copyRectToScreen(w->getBorderSurface()->getBasePtr(MAX(clip.left - outerDims.left, 0), MAX(clip.top - outerDims.top, 0)), w->getBorderSurface()->pitch, clip.left, clip.top, adjWidth, adjHeight);
+				if (_pixelformat.bytesPerPixel == 1) {
+					Surface *surface = g_system->lockScreen();
+					ManagedSurface *border = w->getBorderSurface();
+
+					for (int y = 0; y < adjHeight; y++) {
+						const byte *src = (const byte *)border->getBasePtr(clip.left - outerDims.left, y);
+						byte *dst = (byte *)surface->getBasePtr(clip.left, y + clip.top);
+						for (int x = 0; x < adjWidth; x++, src++, dst++)
+								if (*src != _colorGreen2 && *src != _colorGreen)
+									*dst = *src;
 					}
+
+					g_system->unlockScreen();
+				} else {
+					g_system->copyRectToScreen(w->getBorderSurface()->getBasePtr(MAX(clip.left - outerDims.left, 0), MAX(clip.top - outerDims.top, 0)), w->getBorderSurface()->pitch, clip.left, clip.top, adjWidth, adjHeight);
 				}
 
 				adjustDimensions(clip, innerDims, adjWidth, adjHeight);
@@ -252,13 +252,23 @@ void Texture::updateArea(const Common::Rect &area, const Graphics::Surface &src)
 		return;
 	}
 
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+	// When GL_UNPACK_ROW_LENGTH is available, we can specify the pitch of
+	// the source data and upload just the area.
+	if (OpenGLContext.unpackSubImageSupported && area.width() < src.w) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / src.format.bytesPerPixel));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                       _glFormat, _glType, src.getBasePtr(area.left, area.top)));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+		return;
+	}
+
 	// Update the actual texture.
-	// Although we have the area of the texture buffer we want to update we
-	// cannot take advantage of the left/right boundaries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
+	// Without GL_UNPACK_ROW_LENGTH we cannot take advantage of the left/right
+	// boundaries here because it is not possible to specify a pitch to
+	// glTexSubImage2D. OpenGL ES 1.0 and 2.0 do not support it without an
+	// extension. Thus, we are left with the following options:
 	//
 	// 1) (As we do right now) Simply always update the whole texture lines of
 	//    rect changed. This is simplest to implement. In case performance is
@@ -270,7 +280,6 @@ void Texture::updateArea(const Common::Rect &area, const Graphics::Surface &src)
 	//
 	// 3) Use glTexSubImage2D per line changed. This is what the old OpenGL
 	//    graphics manager did but it is much slower! Thus, we do not use it.
-	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
 	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
 	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
 }
@@ -1550,10 +1550,27 @@ void ThemeEngine::addDirtyRect(Common::Rect r) {
 
 		// Conversely, if we find rectangles which are contained in
 		// the new one, we can remove them
-		if (r.contains(*it))
+		if (r.contains(*it)) {
 			it = _dirtyScreen.erase(it);
-		else
-			++it;
+			continue;
+		}
+
+		// Merge overlapping rectangles if their bounding box is not
+		// larger than the two of them, so the overlap isn't copied to
+		// the screen twice. The grown rectangle may now contain ones we
+		// have already checked, so start over.
+		if (r.intersects(*it)) {
+			Common::Rect merged(r);
+			merged.extend(*it);
+			if (merged.width() * merged.height() <= r.width() * r.height() + it->width() * it->height()) {
+				r = merged;
+				_dirtyScreen.erase(it);
+				it = _dirtyScreen.begin();
+				continue;
+			}
+		}
+
+		++it;
 	}
 
 	// If we got here, we can safely add r to the list of dirty rects.
@@ -199,15 +199,16 @@ bool IntegrityDialog::progressUpdate(int bytesProcessed) {
 
 	g_checksum_state->calculatedSize += bytesProcessed;
 
-	if (g_system->getMillis() > g_checksum_state->lastUpdate + 500) {
-		g_checksum_state->lastUpdate = g_system->getMillis();
+	uint32 now = g_system->getMillis();
+	if (now > g_checksum_state->lastUpdate + 500) {
+		g_checksum_state->lastUpdate = now;
 		g_checksum_state->dialog->sendCommand(kDownloadProgressCmd, 0);
 	}
 
 	Common::Event event;
 	if (g_system->getEventManager()->pollEvent(event)) {
-		if (g_system->getMillis() > g_checksum_state->dialog->_lastEventPoll + 16) {
-			g_checksum_state->dialog->_lastEventPoll = g_system->getMillis();
+		if (now > g_checksum_state->dialog->_lastEventPoll + 16) {
+			g_checksum_state->dialog->_lastEventPoll = now;
 			g_gui.processEvent(event, g_checksum_state->dialog);
 			g_system->updateScreen();
 		}
@@ -383,18 +384,18 @@ void IntegrityDialog::calculateTotalSize(Common::Path gamePath, const Common::Ha
 	}
 }
 
-Common::Array<Common::StringArray> IntegrityDialog::generateChecksums(Common::Path currentPath, Common::Array<Common::StringArray> &fileChecksums, Common::Path gamePath) {
+void IntegrityDialog::generateChecksums(const Common::Path &currentPath, Common::Array<Common::StringArray> &fileChecksums, const Common::Path &gamePath) {
 	const Common::FSNode dir(currentPath);
 
 	if (!dir.exists() || !dir.isDirectory())
-		return {};
+		return;
 
 	Common::FSList fileList;
 	if (!dir.getChildren(fileList, Common::FSNode::kListAll))
-		return {};
+		return;
 
 	if (fileList.empty())
-		return {};
+		return;
 
 	// First, we go through the list and check any Mac files
 	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> macFiles;
@@ -537,7 +538,6 @@ Common::Array<Common::StringArray> IntegrityDialog::generateChecksums(Common::Pa
 
 	if (currentPath == gamePath) // Enter "checksum complete" state only once the whole root directory has been processed
 		setState(kChecksumComplete);
-	return fileChecksums;
 }
 
 Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language) {
@@ -546,7 +546,7 @@ Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, C
 	// Add game path to SearchMan
 	SearchMan.addDirectory(gamePath.toString(), gamePath, 0, 20);
 
-	fileChecksums = generateChecksums(gamePath, fileChecksums, gamePath);
+	generateChecksums(gamePath, fileChecksums, gamePath);
 
 	Common::JSONObject requestObject;
 
@@ -558,7 +558,7 @@ Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, C
 
 	Common::JSONArray filesObject;
 
-	for (Common::StringArray fileChecksum : fileChecksums) {
+	for (const Common::StringArray &fileChecksum : fileChecksums) {
 		Common::JSONObject file;
 		Common::Path relativePath = Common::Path(fileChecksum[0]).relativeTo(gamePath);
 		file.setVal("name", new Common::JSONValue(relativePath.toConfig()));
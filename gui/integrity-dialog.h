@@ -85,7 +85,7 @@ public:
 
 	void calculateTotalSize(Common::Path gamePath, const Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> &ignoredSubdirsMap);
 
-	Common::Array<Common::StringArray> generateChecksums(Common::Path currentPath, Common::Array<Common::StringArray> &fileChecksums, Common::Path gamePath);
+	void generateChecksums(const Common::Path &currentPath, Common::Array<Common::StringArray> &fileChecksums, const Common::Path &gamePath);
 	Common::JSONValue *generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language);
 	void parseJSON(const Common::JSONValue *response);
 
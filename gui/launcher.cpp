@@ -137,41 +137,47 @@ bool LauncherFilterMatcher(void *boss, int idx, const Common::U32String &item, c
 	}
 
 	bool result = false;
+
+	// Plain words are by far the most common filter, so match them
+	// directly instead of converting the token for every single item
+	if (!token.contains(':') && !token.contains('=') && !token.contains('~')) {
+		result = item.contains(token);
+		return invert ? !result : result;
+	}
+
 	Common::String token8 = token;
 	size_t pos = token8.findFirstOf(":=~");
-	if (pos != token8.npos) {
-		Common::String key = token8.substr(0, token8.findFirstOf(token8[pos]));
-		Common::String filter = token8.substr(token8.findFirstOf(token8[pos]) + 1);
-
-		if (key.size()) {
-			if (Common::String("description").hasPrefix(key)) {
-				key = "description";
-			} else if (Common::String("engineid").hasPrefix(key)) {
-				key = "engineid";
-			} else if (Common::String("gameid").hasPrefix(key)) {
-				key = "gameid";
-			} else if (Common::String("language").hasPrefix(key)) {
-				key = "language";
-			} else if (Common::String("path").hasPrefix(key)) {
-				key = "path";
-			} else if (Common::String("platform").hasPrefix(key)) {
-				key = "platform";
-			}
+	assert(pos != token8.npos);
+
+	Common::String key = token8.substr(0, token8.findFirstOf(token8[pos]));
+	Common::String filter = token8.substr(token8.findFirstOf(token8[pos]) + 1);
+
+	if (key.size()) {
+		if (Common::String("description").hasPrefix(key)) {
+			key = "description";
+		} else if (Common::String("engineid").hasPrefix(key)) {
+			key = "engineid";
+		} else if (Common::String("gameid").hasPrefix(key)) {
+			key = "gameid";
+		} else if (Common::String("language").hasPrefix(key)) {
+			key = "language";
+		} else if (Common::String("path").hasPrefix(key)) {
+			key = "path";
+		} else if (Common::String("platform").hasPrefix(key)) {
+			key = "platform";
 		}
+	}
 
-		LauncherDialog *launcher = (LauncherDialog *)(boss);
-		Common::String data = launcher->getGameConfig(idx, key);
-		data.toLowercase();
+	LauncherDialog *launcher = (LauncherDialog *)(boss);
+	Common::String data = launcher->getGameConfig(idx, key);
+	data.toLowercase();
 
-		if (token8[pos] == ':') {
-			result = data.contains(filter);
-		} else if (token8[pos] == '=') {
-			result = data == filter;
-		} else if (token8[pos] == '~') {
-			result = data.matchString(filter);
-		}
-	} else {
-		result = item.contains(token);
+	if (token8[pos] == ':') {
+		result = data.contains(filter);
+	} else if (token8[pos] == '=') {
+		result = data == filter;
+	} else if (token8[pos] == '~') {
+		result = data.matchString(filter);
 	}
 
 	return invert ? !result : result;
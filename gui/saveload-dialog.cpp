@@ -217,6 +217,8 @@ void SaveLoadChooserDialog::open() {
 }
 
 void SaveLoadChooserDialog::close() {
+	_metaInfoCache.clear();
+
 	Dialog::close();
 }
 
@@ -327,6 +329,7 @@ void SaveLoadChooserDialog::updateSaveList(bool external) {
 void SaveLoadChooserDialog::listSaves() {
 	if (!_metaEngine) return; //very strange
 	_saveList = _metaEngine->listSaves(_target.c_str(), _saveMode);
+	_metaInfoCache.clear();
 
 #ifdef USE_CLOUD
 	//if there is Cloud support, add currently synced files as "locked" saves in the list
@@ -356,6 +359,16 @@ void SaveLoadChooserDialog::listSaves() {
 #endif
 }
 
+SaveStateDescriptor SaveLoadChooserDialog::querySaveMetaInfos(int slot) {
+	Common::HashMap<int, SaveStateDescriptor>::const_iterator i = _metaInfoCache.find(slot);
+	if (i != _metaInfoCache.end())
+		return i->_value;
+
+	SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), slot);
+	_metaInfoCache[slot] = desc;
+	return desc;
+}
+
 void SaveLoadChooserDialog::activate(int slot, const Common::U32String &description) {
 	if (!_saveList.empty() && slot < int(_saveList.size())) {
 		const SaveStateDescriptor &desc = _saveList[slot];
@@ -654,7 +667,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : querySaveMetaInfos(_saveList[selItem].getSaveSlot()));
 		if (!_saveList[selItem].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[selItem] = desc;
 
@@ -1169,7 +1182,7 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : querySaveMetaInfos(saveSlot));
 		if (!_saveList[i].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[i] = desc;
 		SlotButton &curButton = _buttons[curNum];
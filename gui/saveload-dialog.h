@@ -112,6 +112,15 @@ protected:
 	*/
 	virtual void listSaves();
 
+	/**
+	 * Query the meta infos of a save from the MetaEngine.
+	 *
+	 * The result is kept until the save list is refreshed, so paging
+	 * through the saves or reselecting one doesn't read the save file
+	 * and decode its thumbnail again.
+	 */
+	SaveStateDescriptor querySaveMetaInfos(int slot);
+
 	void activate(int slot, const Common::U32String &description);
 
 	const bool					_saveMode;
@@ -124,6 +133,7 @@ protected:
 	Common::String				_target;
 	bool _dialogWasShown;
 	SaveStateList				_saveList;
+	Common::HashMap<int, SaveStateDescriptor>	_metaInfoCache;
 	Common::U32String			_resultString;
 
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
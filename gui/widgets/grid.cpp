@@ -590,6 +590,7 @@ void GridWidget::sortGroups() {
 		// as substrings, ignoring case.
 
 		Common::U32StringTokenizer tok(_filter);
+		const Common::U32StringArray tokens = tok.split();
 		Common::U32String tmp;
 		int n = 0;
 
@@ -599,9 +600,8 @@ void GridWidget::sortGroups() {
 			tmp = i->title;
 			tmp.toLowercase();
 			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
+			for (const Common::U32String &token : tokens) {
+				if (!tmp.contains(token)) {
 					matches = false;
 					break;
 				}
@@ -713,8 +713,11 @@ void GridWidget::reloadThumbnails() {
 				path = Common::String::format("icons/%s.png", entry->engineid.c_str());
 				if (!_loadedSurfaces.contains(path)) {
 					surf = loadSurfaceFromFile(path);
-				} else {
-					const Graphics::ManagedSurface *scSurf = _loadedSurfaces[path];
+					// Remember missing engine icons too, so they are not
+					// searched for again for every game of that engine
+					if (!surf)
+						_loadedSurfaces[path] = nullptr;
+				} else if (const Graphics::ManagedSurface *scSurf = _loadedSurfaces[path]) {
 					// TODO: Use SharedPtr instead of duplicating the surface
 					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
 					thSurf->copyFrom(*scSurf);
@@ -740,6 +743,31 @@ void GridWidget::reloadThumbnails() {
 			}
 		}
 	}
+
+	unloadHiddenThumbnails();
+}
+
+void GridWidget::unloadHiddenThumbnails() {
+	// Keep a few screens worth of thumbnails around for scrolling back,
+	// but don't let huge libraries keep every thumbnail in memory
+	const uint maxLoadedSurfaces = MAX<uint>(256, 4 * _visibleEntryList.size());
+	if (_loadedSurfaces.size() <= maxLoadedSurfaces)
+		return;
+
+	Common::HashMap<Common::String, bool> visiblePaths;
+	for (const GridItemInfo *entry : _visibleEntryList)
+		visiblePaths[entry->thumbPath] = true;
+
+	Common::StringArray hiddenPaths;
+	for (const auto &surface : _loadedSurfaces) {
+		if (!visiblePaths.contains(surface._key))
+			hiddenPaths.push_back(surface._key);
+	}
+
+	for (const Common::String &path : hiddenPaths) {
+		delete _loadedSurfaces[path];
+		_loadedSurfaces.erase(path);
+	}
 }
 
 void GridWidget::loadFlagIcons() {
@@ -198,6 +198,7 @@ public:
 	void saveClosedGroups(const Common::U32String &groupName);
 
 	void reloadThumbnails();
+	void unloadHiddenThumbnails();
 	void loadFlagIcons();
 	void loadPlatformIcons();
 	void loadExtraIcons();
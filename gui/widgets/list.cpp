@@ -772,7 +772,9 @@ void ListWidget::setFilter(const Common::U32String &filter, bool redraw) {
 	} else {
 		// Restrict the list to everything which matches all tokens in _filter, ignoring case.
 
+		// Split the filter only once, not for every single item
 		Common::U32StringTokenizer tok(_filter);
+		const Common::U32StringArray tokens = tok.split();
 		Common::U32String tmp;
 		int n = 0;
 
@@ -783,9 +785,8 @@ void ListWidget::setFilter(const Common::U32String &filter, bool redraw) {
 			tmp = i->clean;
 			tmp.toLowercase();
 			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!_filterMatcher(_filterMatcherArg, n, tmp, tok.nextToken())) {
+			for (const Common::U32String &token : tokens) {
+				if (!_filterMatcher(_filterMatcherArg, n, tmp, token)) {
 					matches = false;
 					break;
 				}
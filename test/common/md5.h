@@ -47,4 +47,22 @@ class MD5TestSuite : public CxxTest::TestSuite {
 		}
 	}
 
+	void test_computeStreamMD5_large() {
+		const uint32 size = 200000;
+		byte *data = new byte[size];
+		for (uint32 i = 0; i < size; i++)
+			data[i] = (byte)(i * 7 + 3);
+
+		Common::MemoryReadStream stream(data, size);
+		TS_ASSERT_EQUALS(Common::computeStreamMD5AsString(stream), "d7f02347e9fd18d5b486e864a9d37c08");
+
+		stream.seek(0);
+		TS_ASSERT_EQUALS(Common::computeStreamMD5AsString(stream, 100000), "59f08777fcd1aa2b8e0c8f892cfaae09");
+
+		stream.seek(0);
+		TS_ASSERT_EQUALS(Common::computeStreamMD5AsString(stream, 5000), "33d9712cc5eb0bf18a41ed54a908e412");
+
+		delete[] data;
+	}
+
 };
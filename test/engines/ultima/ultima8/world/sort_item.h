@@ -869,4 +869,33 @@ class U8SortItemTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT(!si1.overlap(si2));
 		TS_ASSERT(!si2.overlap(si1));
 	}
+
+	/* Dependencies are kept in list order, with equal items in insertion order */
+	void test_depends_insert_sorted() {
+		Ultima::Ultima8::SortItem si;
+		Ultima::Ultima8::SortItem si1;
+		Ultima::Ultima8::SortItem si2;
+		Ultima::Ultima8::SortItem si3;
+		Ultima::Ultima8::SortItem si4;
+
+		si1.setBoxBounds(Ultima::Ultima8::Box(0, 0, 0, 32, 32, 8), 0, 0);
+		si2.setBoxBounds(Ultima::Ultima8::Box(0, 0, 8, 32, 32, 8), 0, 0);
+		si3.setBoxBounds(Ultima::Ultima8::Box(32, 32, 8, 32, 32, 8), 0, 0);
+		si4.setBoxBounds(Ultima::Ultima8::Box(0, 0, 16, 32, 32, 8), 0, 0);
+
+		si._depends.insert_sorted(&si2);
+		si._depends.insert_sorted(&si4);
+		si._depends.insert_sorted(&si1);
+		si._depends.insert_sorted(&si3);
+
+		Ultima::Ultima8::SortItem *expected[] = { &si1, &si2, &si3, &si4 };
+		int i = 0;
+		for (auto *d : si._depends) {
+			TS_ASSERT_LESS_THAN(i, 4);
+			if (i < 4)
+				TS_ASSERT_EQUALS(d, expected[i]);
+			i++;
+		}
+		TS_ASSERT_EQUALS(i, 4);
+	}
 };